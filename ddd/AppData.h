@@ -61,6 +61,8 @@
 #define XtCTrace                 "Trace"
 #define XtNplayLog               "playLog"
 #define XtCPlayLog               "PlayLog"
+#define XtNtraceEvents           "traceEvents"
+#define XtCTraceEvents           "TraceEvents"
 #define XtNrestartCommands       "restartCommands"
 #define XtCInitCommands          "InitCommands"
 #define XtNsourceInitCommands    "sourceInitCommands"
@@ -244,6 +246,8 @@
 #define XtCSaveOnExit            "SaveOnExit"
 #define XtNcacheSourceFiles      "cacheSourceFiles"
 #define XtCCacheSourceFiles      "CacheSourceFiles"
+#define XtNlargeSourceSize       "largeSourceSize"
+#define XtCLargeSourceSize       "LargeSourceSize"
 #define XtNcacheMachineCode      "cacheMachineCode"
 #define XtCCacheMachineCode      "CacheMachineCode"
 #define XtNsuppressWarnings      "suppressWarnings"
@@ -260,6 +264,8 @@
 #define XtCBlockTTYInput         "BlockTTYInput"
 #define XtNbufferGDBOutput       "bufferGDBOutput"
 #define XtCBufferGDBOutput       "BufferGDBOutput"
+#define XtNquestionPipelineDepth "questionPipelineDepth"
+#define XtCQuestionPipelineDepth "QuestionPipelineDepth"
 #define XtNdisplayGlyphs         "displayGlyphs"
 #define XtCDisplayGlyphs         "DisplayGlyphs"
 #define XtNmaxGlyphs             "maxGlyphs"
@@ -329,10 +335,14 @@
 #define XtCShowMemberNames       "ShowMemberNames"
 #define XtNexpandRepeatedValues  "expandRepeatedValues"
 #define XtCExpandRepeatedValues  "ExpandRepeatedValues"
+#define XtNarrayWindowSize       "arrayWindowSize"
+#define XtCArrayWindowSize       "ArrayWindowSize"
 #define XtNbumpDisplays          "bumpDisplays"
 #define XtCBumpDisplays          "BumpDisplays"
 #define XtNhideInactiveDisplays  "hideInactiveDisplays"
 #define XtCHideInactiveDisplays  "HideInactiveDisplays"
+#define XtNuseMIVariables        "useMIVariables"
+#define XtCUseMIVariables        "UseMIVariables"
 #define XtNshowBaseDisplayTitles "showBaseDisplayTitles"
 #define XtNshowDependentDisplayTitles "showDependentDisplayTitles"
 #define XtCShowDisplayTitles     "ShowDisplayTitles"
@@ -411,6 +421,7 @@ struct AppData {
     Boolean   open_selection;
     Boolean   trace;
     const _XtString    play_log;
+    const _XtString    trace_events;
     const _XtString    restart_commands;
     Boolean   source_init_commands;
     const _XtString    init_symbols;
@@ -512,6 +523,7 @@ struct AppData {
     Boolean   save_history_on_exit;
     Boolean   save_options_on_exit;
     Boolean   cache_source_files;
+    Cardinal  large_source_size;
     Boolean   cache_machine_code;
     Boolean   suppress_warnings;
     Boolean   warn_if_locked;
@@ -519,6 +531,7 @@ struct AppData {
     Boolean   tty_mode;
     OnOff     block_tty_input;
     OnOff     buffer_gdb_output;
+    int       question_pipeline_depth;
     Cardinal  annotate;
     Boolean   display_glyphs;
     Cardinal  max_glyphs;
@@ -560,8 +573,10 @@ struct AppData {
     unsigned char struct_orientation;
     Boolean   show_member_names;
     Boolean   expand_repeated_values;
+    Cardinal  array_window_size;
     Boolean   bump_displays;
     Boolean   hide_inactive_displays;
+    Boolean   use_mi_variables;
     Boolean   show_base_display_titles;
     Boolean   show_dependent_display_titles;
     Boolean   cluster_displays;
@@ -76,6 +76,10 @@ typedef std::vector<CodeCacheEntry> CodeCache;
 // return Z such that Z < 0 if X < Y, Z == 0 if X == Y, Z > 0 if X > Y
 int compare_address(const string& x, const string& y);
 
+// Return a key for address X, such that
+// compare_address(X, Y) == 0 iff address_key(X) == address_key(Y)
+string address_key(const string& x);
+
 // Return true if C is a leading zero character
 inline bool is_leading_zero(char c)
 {
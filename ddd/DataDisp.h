@@ -83,6 +83,7 @@ class DispBox;
 class DispValue;
 class RegionGraphNode;
 class ThemeManager;
+class VarObj;
 
 //-----------------------------------------------------------------------------
 class DataDisp {
@@ -100,6 +101,7 @@ class DataDisp {
     static void dereferenceCB           (Widget, XtPointer, XtPointer);
     static void dereferenceArgCB        (Widget, XtPointer, XtPointer);
     static void dereferenceInPlaceCB    (Widget, XtPointer, XtPointer);
+    static void sliceCB                 (Widget, XtPointer, XtPointer);
     static void toggleDetailCB          (Widget, XtPointer, XtPointer);
     static void toggleRotateCB          (Widget, XtPointer, XtPointer);
     static void toggleDisableCB         (Widget, XtPointer, XtPointer);
@@ -240,6 +242,7 @@ class DataDisp {
     static void graph_dereferenceAct    (Widget, XEvent*, String*, Cardinal*);
     static void graph_detailAct         (Widget, XEvent*, String*, Cardinal*);
     static void graph_rotateAct         (Widget, XEvent*, String*, Cardinal*);
+    static void graph_sliceAct          (Widget, XEvent*, String*, Cardinal*);
     static void graph_dependentAct      (Widget, XEvent*, String*, Cardinal*);
 
     static void call_selection_proc(Widget, const _XtString, XEvent*, String*, Cardinal,
@@ -426,6 +429,11 @@ public:
     static string process_displays(string& display_answer,
 				   bool& disabling_occurred);
 
+    // Process the answers to the `-var-update' and `-var-create'
+    // commands CMDS, as issued by add_refresh_data_commands().
+    static void process_mi_update(const std::vector<string>& cmds,
+				  const std::vector<string>& answers);
+
     // Process user-defined command output in ANSWERS.
     static void process_user(std::vector<string>& answers);
 
@@ -457,6 +465,16 @@ private:
     // Tons of helpers
     static void new_data_displayOQC      (const string& answer, void* data);
     static void new_data_display_extraOQC(const string& answer, void* data);
+    static void new_mi_data_displayOQC   (const string& answer, void* data);
+    static void new_mi_data_displayVOP   (VarObj *var, const string& msg,
+					  void *data);
+
+    // (Re-)create variable object of display NR
+    static void create_display_varobj(int nr, const string& answer);
+    static void display_varobjVOP(VarObj *var, const string& msg, 
+				  void *data);
+    static void recreate_display_varobjsOQA(const std::vector<string>& 
+					    answers, void *data);
 
     static void new_user_displayOQC  (const string& answer, void* data);
 
@@ -480,6 +498,18 @@ private:
     static int unfold_expressions(const string& display_expression,
 				  std::vector<string>& expressions);
 
+    // Array slices
+    static int array_length(string type);
+    static bool may_be_windowed(const string& expr);
+    static string neighbor_slice(const string& expr, int direction,
+				 int length);
+    static void replace_sliceOQA(const string& type, void *data);
+    static void new_windowed_displaysOQA(const std::vector<string>& types,
+					 void *data);
+    static void new_data_displaysSQ(const std::vector<string>& expressions,
+				    NewDisplayInfo& info, bool do_prompt,
+				    int priority = COMMAND_PRIORITY_SYSTEM);
+
     // Get display number and name from ANSWER; store them in NR and NAME
     static void read_number_and_name(string& answer, string& nr, string& name);
 
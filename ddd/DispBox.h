@@ -59,7 +59,7 @@ private:
 
     static bool is_numeric(const DispValue *dv, const DispValue *parent);
 
-    static struct VSLLibCache *vsllib_cache;
+    static std::vector<VSLLib *> vsllib_cache;
 
 protected:
     static DataLink data_link;
@@ -89,6 +89,7 @@ public:
 
     // Clear cache
     static void clear_vsllib_cache();
+    static void clear_box_memo();
 
     // Create a new box.  If DV == 0, create a disabled box.
     DispBox (int disp_nr, const string& title, 
@@ -120,6 +121,11 @@ private:
     static ThemedVSLLib *vsllib_ptr;
     static VSLLib *vsllib(const DispValue *dv);
 
+    static string memo_key(const DispValue *dv, const string& func,
+			   const string& args);
+    static Box *memoized(const string& key);
+    static void memoize(const string& key, Box *box);
+
 protected:
     // Evaluation functions
     static Box *check(const string& func_name, const Box *box);
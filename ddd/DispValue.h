@@ -42,10 +42,13 @@
 
 #include <vector>
 #include <map>
+#include <set>
 
 
 class Agent;
 class PlotAgent;
+struct PlotRequest;
+struct PlotDump;
 
 typedef unsigned char DispValueOrientation;
 const unsigned char Vertical   = XmVERTICAL;
@@ -75,6 +78,10 @@ class DispValue {
     // Plotting stuff
     mutable PlotAgent *m_plotter;	// Plotting agent
 
+    // Content summary
+    unsigned long long m_hash;	// Hash over contents of this subtree
+    bool m_children_changed;	// True iff some descendant is changed
+
     // Caching stuff
     Box *m_cached_box;		    // Last box
     int m_cached_box_change;        // Last cached box change
@@ -93,19 +100,20 @@ class DispValue {
 
     // Helpers
     static StringStringAssoc type_cache;
+    static std::set<string> window_slices;
     static int index_base(const string& expr, int dim);
     static string add_member_name(const string& base, 
 				  const string& member_name);
 
     // Plotting stuff
     bool getGnuplotType(string expr, string &gdbtype, string &gnuplottype, string &sizestr) const;
-    bool _plot(PlotAgent *plotter) const;
+    bool _plot(PlotAgent *plotter, PlotRequest *request) const;
     bool plot1d(PlotAgent *plotter) const;
-    bool plot2d(PlotAgent *plotter) const;
-    bool plot3d(PlotAgent *plotter) const;
-    bool plotVector(PlotAgent *plotter) const;
-    bool plotImage(PlotAgent *plotter) const;
-    bool plotCVMat(PlotAgent *plotter) const;
+    bool plot2d(PlotAgent *plotter, PlotRequest *request) const;
+    bool plot3d(PlotAgent *plotter, PlotRequest *request) const;
+    bool plotVector(PlotAgent *plotter, PlotRequest *request) const;
+    bool plotImage(PlotAgent *plotter, PlotRequest *request) const;
+    bool plotCVMat(PlotAgent *plotter, PlotRequest *request) const;
     bool can_plot1d() const;
     bool can_plot2d() const;
     bool can_plot3d() const;
@@ -116,10 +124,19 @@ class DispValue {
 
     static void PlotterDiedHP(Agent *, void *, void *);
 
+    // Binary plots: GDB answers
+    static void plot_infoOQA(const std::vector<string>& answers, void *data);
+    static void plot_dumpOQA(const std::vector<string>& answers, void *data);
+    static void dump_plot(PlotDump *dump, const string& range, bool first);
+    static void plot_done(PlotRequest *request);
+
     // Update helper
     DispValue *_update(DispValue *source, 
 		       bool& was_changed, bool& was_initialized);
 
+    // Recompute content summary from own and children's contents
+    void summarize();
+
     // Clear cached box
     void clear_cached_box()
     {
@@ -259,11 +276,12 @@ public:
     bool has_plot_orientation()  const { return m_has_plot_orientation; }
 
     int& repeats()       { clear_cached_box(); return m_repeats; }
-    string& full_name()  { clear_cached_box(); return m_full_name; }
+    string& full_name()  { clear_cached_box(); m_hash = 0; return m_full_name; }
     string& name()       { clear_cached_box(); return m_print_name; }
     bool& enabled()      { clear_cached_box(); return m_enabled; }
 
     bool is_changed() const { return m_changed; }
+    unsigned long long hash() const { return m_hash; }
     bool descendant_changed() const;
     bool expanded()   const { return m_expanded; }
     bool collapsed()  const { return !expanded(); }
@@ -380,6 +398,13 @@ public:
     // Clear cache of all types read so far
     static void clear_type_cache();
 
+    // Note that EXPR is a slice `A[FIRST]@COUNT' created by DDD.  Its
+    // elements are named `A[FIRST]', `A[FIRST + 1]', etc.
+    static void add_window_slice(const string& expr)
+    {
+	window_slices.insert(expr);
+    }
+
     // Hook for inserting previously computed DispValues
     static DispValue *(*value_hook)(string& value);
 
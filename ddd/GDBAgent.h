@@ -192,6 +192,8 @@ protected:
     bool _has_addproc_command;
     bool _has_debug_command;
     bool _is_windriver_gdb;
+    bool _has_mi_varobjs;
+    string _version;		// Debugger version
 
     ProgramLanguage _program_language; // Current program language
 
@@ -200,6 +202,8 @@ protected:
     bool _detect_echos;		// True if echos are to be detected
     bool _buffer_gdb_output;	// True if GDB output is to be buffered
     bool _flush_next_output;	// True if next GDB output is to be flushed
+    int _pipeline_depth;	// Max # of questions sent ahead
+    bool _paging_off;		// True if GDB does not page its output
 
     string last_prompt;		// Last prompt received
     string last_written;	// Last command sent
@@ -339,6 +343,10 @@ public:
     bool has_display_command() const   { return _has_display_command; }
     bool has_display_command(bool val) { return _has_display_command = val; }
 
+    // True if debugger provides GDB/MI variable objects
+    bool has_mi_varobjs() const        { return _has_mi_varobjs; }
+    bool has_mi_varobjs(bool val)      { return _has_mi_varobjs = val; }
+
     // True if debugger has `clear' command
     bool has_clear_command() const     { return _has_clear_command; }
     bool has_clear_command(bool val)   { return _has_clear_command = val; }
@@ -438,6 +446,10 @@ public:
     bool is_windriver_gdb() const   { return _is_windriver_gdb; }
     bool is_windriver_gdb(bool val) { return _is_windriver_gdb = val; }
 
+    // Debugger version, as reported by the debugger; empty if unknown
+    const string& version() const             { return _version; }
+    const string& version(const string& val)  { return _version = val; }
+
     // Current program language
     ProgramLanguage program_language() const   { return _program_language; }
     ProgramLanguage program_language(ProgramLanguage val) 
@@ -623,13 +635,14 @@ public:
     // True if `display X' automatically prints X
     bool display_prints_values() const
     {
-      return type() == GDB || type() == PYDB ;
+      return (type() == GDB || type() == PYDB) && has_display_command();
     }
 
     // True if debugger can enable displays
     bool has_enable_display_command() const
     {
-	return type() == GDB || type() == PYDB || type() == DBG;
+	return (type() == GDB || type() == PYDB || type() == DBG)
+	    && has_display_command();
     }
     bool has_disable_display_command() const
     {
@@ -639,7 +652,8 @@ public:
     // True if debugger has numbered displays
     bool has_numbered_displays() const
     {
-	return type() == GDB || type() == PYDB || type() == DBG;
+	return (type() == GDB || type() == PYDB || type() == DBG)
+	    && has_display_command();
     }
 
     // True if debugger wants displays separated by `,'
@@ -715,6 +729,15 @@ public:
     bool flush_next_output() const       { return _flush_next_output; }
     bool flush_next_output(bool val)     { return _flush_next_output = val; }
 
+    // Number of questions from a question array that may be sent
+    // without waiting for the preceding answers (1: wait for each)
+    int pipeline_depth() const           { return _pipeline_depth; }
+    int pipeline_depth(int val)          { return _pipeline_depth = val; }
+
+    // Note that CMD is executed (say, from a sourced file), such that
+    // we know whether GDB pages its output
+    void track_paging(const string& cmd);
+
     // Place quotes around filename FILE if needed
     string quote_file(const string& file) const;
 
@@ -751,12 +774,24 @@ public:
     string dereferenced_expr(const string& expr) const;    // *EXPR
     string address_expr(string expr) const;         // &EXPR
     string index_expr(const string& expr, const string& index) const; // EXPR[INDEX]
+    string slice_expr(const string& expr, int first, int count) const;
+						    // EXPR[FIRST]@COUNT
+    bool split_slice_expr(const string& slice, string& expr, 
+			  int& first, int& count) const;
     int default_index_base() const;                 // 0 in C, else 1
     string member_separator() const;                // " = " in C
 
     virtual string info_locals_command() const { return "info locals"; }
     virtual string info_args_command() const { return "info args"; }
     virtual string info_display_command() const { return display_command(); }
+    string mi_command(const string& command) const; // interpreter-exec mi CMD
+    virtual string var_create_command(const string& expr) const
+	{ /*UNUSED*/ (void (expr)); return ""; }
+    virtual string var_list_children_command(const string& name) const
+	{ /*UNUSED*/ (void (name)); return ""; }
+    virtual string var_update_command() const { return ""; }
+    virtual string var_delete_command(const string& name) const
+	{ /*UNUSED*/ (void (name)); return ""; }
     string disassemble_command(string start, const char *end = "") const;
                                                     // disassemble START END
     string disassemble_command(const string &start, const string& end ) const {
@@ -872,6 +907,9 @@ private:
 
     int     qu_index;
     int    _qu_count;
+    int     qu_sent;		// Questions written so far
+    double  qu_start;		// Time the first question was written
+    double  qu_answered;	// Time the last answer was complete
     std::vector<string> cmd_array;
     std::vector<string> complete_answers;
     VoidArray _qu_datas;
@@ -886,9 +924,22 @@ private:
 			   int      qu_count,
 			   OQACProc on_qu_array_completion,
 			   void*    qa_data);
+    void    send_questions();
+    void    send_next_questions();
+    void    split_at_prompt(string& answer, string& rest);
+    static bool is_plain_query(const string& cmd);
 
     string requires_reply(const string& answer);
 
+    // Incremental prompt recognition
+    const string *prompt_scan_answer; // Answer being scanned
+    int prompt_scan_end;	      // Length scanned so far
+    int prompt_scan_line;	      // Start of last line
+    int prompt_scan_prev_line;	      // Start of line before last line
+
+    bool answer_ends_with_prompt(const string& answer);
+    void reset_prompt_scan();
+
     void strip_dbx_comments(string& answer) const;
 
     void normalize_answer(string& answer) const;
@@ -58,6 +58,10 @@ public:
     string detach_command(int pid) const override
 	{ /*UNUSED*/ (void (pid)); return "detach"; }
     string assign_command(const string& var, const string& expr) const override;
+    string var_create_command(const string& expr) const override;
+    string var_list_children_command(const string& name) const override;
+    string var_update_command() const override;
+    string var_delete_command(const string& name) const override;
     string init_commands() const override 
         { return GDBAgent_GDB_init_commands; }
     string settings() const override 
@@ -94,6 +94,13 @@ public:
 
     // Start plotting new data with TITLE in NDIM dimensions
     PlotElement &start_plot(const string& title);
+
+    // The elements started since the last flush
+    int nelements() const { return elements.size(); }
+    PlotElement &element(int i) { return elements[i]; }
+
+    // Discard the elements started since the last flush
+    void discard() { reset(); }
     void open_stream(const PlotElement &emdata);
 
     // Add plot point
@@ -70,6 +70,16 @@ private:
     int char_count = 0;
     std::vector<XmTextPosition> textpos_of_line;
     std::vector<unsigned int> bytepos_of_line;
+    std::vector<unsigned int> bytepos_of_checkpoint; // Every 64th character
+
+    // The line index covers current_source up to INDEXED_BYTES
+    // (INDEXED_CHARS characters).  Large sources are indexed on demand
+    // and in a background work procedure; until then, CHAR_COUNT is
+    // estimated from the UTF-8 lead bytes.
+    int indexed_bytes = 0;
+    int indexed_chars = 0;
+    bool index_complete = true;
+    XtWorkProcId index_proc = 0;
 
     // The origin of the current source text.
     SourceOrigin current_origin = ORIGIN_NONE;
@@ -83,6 +93,7 @@ private:
         string text;
         SourceOrigin origin;
         string file_name; // File name of current source (for JDB)
+        int tab_width;    // Tab width used for formatting
     };
     std::map<string, FileCacheEntry> filecache;
     std::map<string, string> source_name_cache;
@@ -102,13 +113,26 @@ private:
                                   const string& text, const _XtString name = 0,
                                   Widget origin = 0);
     // Read source text
-    String read_local(const string& file_name, long& length, bool silent);
+    String read_local(const string& file_name, long& length, bool silent,
+                      bool *mapped = 0);
     String read_remote(const string& file_name, long& length, bool silent);
     String read_class(const string& class_name, string& file_name, SourceOrigin& origin,
                              long& length, bool silent);
     String read_from_gdb(const string& source_name, long& length, bool silent);
     String read_indented(string& file_name, long& length, SourceOrigin& origin, bool silent);
 
+    // Byte position of character POS, clamped to the source text
+    int bytepos_of_char(XmTextPosition pos);
+
+    // Line index
+    void start_index(Widget w);
+    bool index_chunk(int bytes);
+    void index_to_bytepos(int pos);
+    void index_to_charpos(XmTextPosition pos);
+    void index_to_line(int line);
+    void index_all() { index_to_bytepos(current_source.length()); }
+    static Boolean IndexWorkProc(XtPointer client_data);
+
 public:
 
     // The current directory
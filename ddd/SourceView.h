@@ -48,6 +48,8 @@
 #define _DDD_SourceView_h
 
 #include <vector>
+#include <map>
+#include <limits.h>
 
 // Motif includes
 #include <Xm/Xm.h>
@@ -313,6 +315,29 @@ class SourceView {
     // The breakpoint map
     static Map<int, BreakPoint> bp_map;
 
+    // Breakpoint index, rebuilt from BP_MAP by process_info_bp().
+    // Values are ranks in BP_ORDER, which lists the breakpoint
+    // numbers in BP_MAP order.
+    static std::vector<int> bp_order;
+    static std::map<string, std::map<int, std::vector<int> > > bps_by_file;
+    static std::map<string, std::vector<int> > bps_by_address;
+    static void index_breakpoints();
+    static std::vector<int> breakpoint_numbers(std::vector<int>& ranks);
+    static std::vector<int> breakpoints_in_bases(const string& base1,
+                                                 const string& base2,
+                                                 int first, int last);
+
+    // Breakpoints that may be in FILE (or the current file) between
+    // lines FIRST and LAST; candidates for bp_matches(), in BP_MAP order
+    static std::vector<int> breakpoints_in_file(const string& file,
+                                                int first = INT_MIN,
+                                                int last = INT_MAX);
+    static std::vector<int> breakpoints_in_source(int first = INT_MIN,
+                                                  int last = INT_MAX);
+
+    // Breakpoints with a location at ADDRESS, in BP_MAP order
+    static std::vector<int> breakpoints_at_address(const string& address);
+
     // File attributes
     static IntIntArrayAssoc bps_in_line;  // non-glyph breakpoints in current source
     static std::vector<string> bp_addresses; // breakpoint addresses in current code
@@ -406,6 +431,7 @@ class SourceView {
 
     // Assembler code display routines.
     static XmTextPosition find_pc(const string& pc);
+    static string code_line_address(XmTextPosition& pos);
     static void refresh_codeOQC(const string& answer, void *data);
     static void set_code(const string& code,
                          const string& start,
@@ -420,11 +446,18 @@ class SourceView {
     // Make address from ADDRESS
     static string make_address(long address);
 
-    // Return FUNCTION and OFFSET at ADDRESS
-    static void get_func_at(const string& address, string& func, int& offset);
+    // Return FUNCTION and OFFSET from ANSWER, the answer to `x /i ADDRESS'
+    static void get_func_at(const string& answer, string& func, int& offset);
     
-    // Check if function at PC is larger than MAX_SIZE
-    static bool function_is_larger_than(string pc, int max_size);
+    // Check if function at PC is larger than MAX_DISASSEMBLE;
+    // then disassemble it
+    static void func_at_pcOQC(const string& answer, void *data);
+    static void func_at_endOQC(const string& answer, void *data);
+    static void disassemble_pc(const string& pc, XmHighlightMode mode,
+                               bool too_large);
+
+    // Show position found by lookup()
+    static void show_lookup_position(const string& pos, void *data);
 
     // Breakpoint properties.
     static void update_properties_panel(BreakpointPropertiesInfo *info);
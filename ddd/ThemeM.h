@@ -31,18 +31,56 @@
 #include "StringTPA.h"
 #include "ThemeP.h"
 #include <iostream>
+#include <map>
+#include <vector>
 
 class ThemeManager {
 private:
     StringThemePatternAssoc map;
 
+    // A glob pattern of theme THEME, with literal PREFIX and SUFFIX
+    // for quick rejection
+    struct GlobPattern {
+	string pattern;
+	string prefix;
+	string suffix;
+	int theme;
+    };
+
+    // The active patterns, compiled on demand
+    struct Compiled {
+	bool valid;
+	std::vector<string> themes;		    // Theme names, in order
+	std::map<string, std::vector<int> > exact; // Literal patterns
+	std::vector<GlobPattern> globs;	    // Other patterns
+
+	Compiled()
+	    : valid(false), themes(), exact(), globs()
+	{}
+    };
+    mutable Compiled compiled;
+
+    // Theme sets of expressions seen so far
+    mutable std::map<string, int> set_cache;
+
+    // Theme sets, interned
+    static std::vector< std::vector<string> > theme_sets;
+    static std::map<std::vector<string>, int> theme_set_ids;
+
+    void compile() const;
+    void invalidate() const
+    {
+	compiled = Compiled();
+	set_cache.clear();
+    }
+
 protected:
     static string read_word(string& value);
 
 public:
     // Create as empty
     ThemeManager()
-	: map()
+	: map(), compiled(), set_cache()
     {}
 
     // Create from external representation REP
@@ -51,19 +89,23 @@ public:
     // Add pattern
     void add(const string& theme, const ThemePattern& pattern)
     {
+	invalidate();
 	map[theme] = pattern;
     }
 
     // Copy constructor
     ThemeManager(const ThemeManager& t)
-	: map(t.map)
+	: map(t.map), compiled(), set_cache()
     {}
 
     // Assignment
     ThemeManager& operator = (const ThemeManager& t)
     {
         if (this != &t)
-	  map = t.map;
+	{
+	    map = t.map;
+	    invalidate();
+	}
 	return *this;
     }
 
@@ -71,7 +113,20 @@ public:
     friend std::ostream& operator<<(std::ostream& os, const ThemeManager& t);
 
     // Get list of themes for an expression
-    std::vector<string> themes(const string& expr) const;
+    std::vector<string> themes(const string& expr) const
+    {
+	return themes_of(theme_set(expr));
+    }
+
+    // Get theme set of an expression.  Equal lists of themes have
+    // equal set numbers, even across theme managers.
+    int theme_set(const string& expr) const;
+
+    // Get list of themes in theme set SET
+    static const std::vector<string>& themes_of(int set)
+    {
+	return theme_sets[set];
+    }
 
     // Get all themes
     std::vector<string> themes() const;
@@ -85,6 +140,7 @@ public:
     // Get pattern of theme
     ThemePattern& pattern(const string& theme)
     {
+	invalidate();
 	return map[theme];
     }
 
@@ -0,0 +1,128 @@
+// $Id$ -*- C++ -*-
+// GDB/MI variable objects
+
+// Copyright (C) 2026 Free Software Foundation, Inc.
+//
+// This file is part of DDD.
+//
+// DDD is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public
+// License as published by the Free Software Foundation; either
+// version 3 of the License, or (at your option) any later version.
+//
+// DDD is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+// See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public
+// License along with DDD -- see the file COPYING.
+// If not, see <http://www.gnu.org/licenses/>.
+//
+// DDD is the data display debugger.
+// For details, see the DDD World-Wide-Web page,
+// `http://www.gnu.org/software/ddd/',
+// or send a mail to the DDD developers <ddd@gnu.org>.
+
+#ifndef _DDD_VarObj_h
+#define _DDD_VarObj_h
+
+#include "base/strclass.h"
+#include "base/bool.h"
+
+#include <iostream>
+#include <map>
+#include <vector>
+
+class MIValue;
+class VarObj;
+
+// Called when a variable object is complete.  VAR is 0 if it could
+// not be created; then, MSG is the error message, or NO_GDB_ANSWER if
+// the questions were canceled.
+typedef void (*VarObjProc)(VarObj *var, const string& msg, void *data);
+
+// A VarObj mirrors a GDB/MI variable object and its children.  After
+// each stop, a single `-var-update' reports the variable objects
+// whose value has changed; only these need to be updated.
+class VarObj {
+    string _name;		// Variable object name, as in `var1.a'
+    string _exp;		// Expression relative to parent, as in `a'
+    string _type;		// Type
+    string _value;		// Value; `{...}' for structs
+    int _numchild;		// Number of children, as reported by GDB
+    VarObj *_parent;		// Parent; 0 if root
+    std::vector<VarObj *> _children;
+
+    // Root only
+    bool _changed;		// True if some value has changed
+    bool _valid;		// False if the object must be re-created
+    string _printed;		// Cached print_value()
+
+    // All variable objects, indexed by name
+    static std::map<string, VarObj *> all;
+
+    VarObj(const MIValue& info, VarObj *parent);
+
+    // Fetch the children of PARENTS from GDB, one nesting level per
+    // batch of questions; call PROC when done
+    static void fetch_children(VarObj *root, 
+			       const std::vector<VarObj *>& parents,
+			       VarObjProc proc, void *data);
+    static void fetch_childrenOQA(const std::vector<string>& answers,
+				  void *data);
+
+    // Add children from `-var-list-children' ANSWER.  Append those
+    // that have children in turn to COMPOSITES.
+    void add_children(const string& answer, 
+		      std::vector<VarObj *>& composites);
+
+    // Print value resp. members in GDB syntax
+    void print(std::ostream& os) const;
+    void print_members(std::ostream& os, bool& first) const;
+
+    VarObj(const VarObj&);
+    VarObj& operator = (const VarObj&);
+
+public:
+    ~VarObj();
+
+    // Create a variable object (and its children) from the answer
+    // to `-var-create'.  The children are fetched asynchronously,
+    // before any other queued command; PROC is called with DATA as
+    // soon as the variable object is complete.
+    static void create(const string& answer, VarObjProc proc, void *data);
+
+    // Delete this variable object in GDB and here
+    void destroy();
+
+    // Process the answer to `-var-update', marking changed and
+    // invalid variable objects.
+    static void process_update(const string& answer);
+
+    const string& name() const  { return _name; }
+    const string& exp() const   { return _exp; }
+    const string& type() const  { return _type; }
+    const string& value() const { return _value; }
+    VarObj *parent() const      { return _parent; }
+    VarObj *root();
+
+    bool changed() const       { return _changed; }
+    bool changed(bool val)     { return _changed = val; }
+    bool valid() const         { return _valid; }
+
+    // True if this is a struct, union, or array
+    bool is_composite() const;
+
+    // True if this is a C++ `public', `private', or `protected' child
+    bool is_access_specifier() const;
+
+    // True if this is a C++ base class child
+    bool is_base_class() const;
+
+    // The value in GDB `print' syntax, as in `{a = 1, b = {2, 3}}'
+    const string& print_value();
+};
+
+#endif // _DDD_VarObj_h
+// DON'T ADD ANYTHING BEHIND THIS #endif
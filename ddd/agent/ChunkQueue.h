@@ -41,6 +41,18 @@ extern "C" void *memcpy(void *to, const void *from, size_t size);
     ChunkQueue is a character array that grows dynamically.
     Characters can easily be appended at the end and
     removed from the beginning (hence the name "queue").
+
+    Valid data is kept in one contiguous, NUL-terminated window
+    [_start, _start + _length) of the allocated memory, so that
+    parsers can always access it as a plain `const char *'.
+    Discarding from the beginning simply advances the window (O(1));
+    memory is only compacted or grown (geometrically) on append, such
+    that the total cost of copying is amortized linear in the amount
+    of data passed through the queue.
+
+    Readers may also fill the queue in place: reserve() returns a
+    pointer to free space for at least LEN characters at the end of
+    the queue; commit() makes the first LEN of them valid data.
 */
 
 class ChunkQueue {
@@ -48,18 +60,42 @@ public:
     DECLARE_TYPE_INFO
 
 private:
+    int _start;		// start of valid data
     int _length;	// length of valid data
     int _size;		// size of allocated memory
     char *_data;	// data
 
+    // Make room for at least LEN more characters (plus '\0')
+    void make_room(int len)
+    {
+	int needed = _length + len + 1;
+	if (_start + needed <= _size)
+	    return;		// Enough room at end
+
+	if (needed <= _size && _start >= _length)
+	{
+	    // Enough room after compacting, and the data to move
+	    // is no larger than what has been discarded before.
+	    memmove(_data, _data + _start, _length + 1);
+	    _start = 0;
+	    return;
+	}
+
+	int newSize = _size * 2;
+	if (newSize < needed)
+	    newSize = needed;
+	grow(newSize);
+    }
+
     // Grow to specific size
     void grow(int newSize)
     {
-	_size = newSize;
-	char *newData = new char[_size];
-	memcpy(newData, _data, _length);
+	char *newData = new char[newSize];
+	memcpy(newData, _data + _start, _length + 1);
 	delete[] _data;
-	_data = newData;
+	_data  = newData;
+	_size  = newSize;
+	_start = 0;
     }
 
     ChunkQueue(const ChunkQueue&);
@@ -69,8 +105,11 @@ private:
 public:
     // Constructor
     ChunkQueue(int initialSize = BUFSIZ)
-	: _length(0), _size(initialSize), _data(new char [initialSize])
-    {}
+	: _start(0), _length(0), _size(initialSize < 1 ? 1 : initialSize),
+	  _data(new char [_size])
+    {
+	_data[0] = '\0';
+    }
 
     // Destructor
     virtual ~ChunkQueue()
@@ -81,12 +120,25 @@ public:
     // Append data <dta> with length <len> at the end
     void append(const char *dta, int len)
     {
-	if (_length + len + 1 > _size)
-	    grow(_length + len + 1);
+	memcpy(reserve(len), dta, len);
+	commit(len);
+    }
+
+    // Return space for <len> characters at the end
+    char *reserve(int len)
+    {
+	make_room(len);
+	return _data + _start + _length;
+    }
+
+    // Make the first <len> reserved characters valid data
+    void commit(int len)
+    {
+	assert(len >= 0);
+	assert(_start + _length + len < _size);
 
-	memcpy(_data + _length, dta, len + 1);
 	_length += len;
-	_data[_length] = '\0';
+	_data[_start + _length] = '\0';
     }
 
     // Discard <len> characters from beginning
@@ -94,25 +146,29 @@ public:
     {
 	assert(len <= _length);
 
-	if (len > 0)
+	if (len >= _length)
+	{
+	    discard();
+	}
+	else if (len > 0)
 	{
-	    if (len < _length)
-		memcpy(_data, _data + len, _length);
+	    _start  += len;
 	    _length -= len;
-	    _data[_length] = '\0';
 	}
     }
 
     // Discard entire queue
     void discard()
     {
+	_start  = 0;
 	_length = 0;
-	_data[_length] = '\0';
+	_data[0] = '\0';
     }
 
     // Resources
-    const char *data() const { return _data; }
+    const char *data() const { return _data + _start; }
     int length() const { return _length; }
+    int size() const   { return _size; }
 };
 
 #endif
@@ -0,0 +1,116 @@
+// $Id$
+// Timing traces in Chrome `trace_event' format
+
+// Copyright (C) 2026 Free Software Foundation, Inc.
+//
+// This file is part of DDD.
+//
+// DDD is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public
+// License as published by the Free Software Foundation; either
+// version 3 of the License, or (at your option) any later version.
+//
+// DDD is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+// See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public
+// License along with DDD -- see the file COPYING.
+// If not, see <http://www.gnu.org/licenses/>.
+//
+// DDD is the data display debugger.
+// For details, see the DDD World-Wide-Web page,
+// `http://www.gnu.org/software/ddd/',
+// or send a mail to the DDD developers <ddd@gnu.org>.
+
+#ifndef _DDD_TraceEvents_h
+#define _DDD_TraceEvents_h
+
+// TraceEvents writes timing events to a file in the JSON format read
+// by chrome://tracing and Perfetto.  Unless a trace file is open,
+// recording an event costs a single test.
+
+#include <stdio.h>
+#include "bool.h"
+
+class TraceEvents {
+private:
+    static FILE *file;		// Trace file; 0 if not tracing
+    static int events;		// # of events written
+
+    static void event(const char *name, const char *cat, char phase,
+		      double ts, double dur, unsigned long id,
+		      const char *detail);
+
+public:
+    // True iff tracing
+    static bool enabled() { return file != 0; }
+
+    // Start writing events to FILENAME; return true iff ok
+    static bool open(const char *filename);
+
+    // Finish trace file
+    static void close();
+
+    // Current time, in microseconds
+    static double now();
+
+    // Record an event NAME of category CAT that started at START and
+    // ends now.  DETAIL, if given, is shown as argument.
+    static void complete(const char *name, const char *cat, double start,
+			 const char *detail = 0)
+    {
+	if (enabled())
+	    event(name, cat, 'X', start, now() - start, 0, detail);
+    }
+
+    // Record an event NAME that occurs now
+    static void instant(const char *name, const char *cat,
+			const char *detail = 0)
+    {
+	if (enabled())
+	    event(name, cat, 'i', now(), 0.0, 0, detail);
+    }
+
+    // Record begin and end of an asynchronous event NAME, identified
+    // by ID.  Asynchronous events may span several callbacks.
+    static void begin(const char *name, const char *cat, unsigned long id,
+		      const char *detail = 0)
+    {
+	if (enabled())
+	    event(name, cat, 'b', now(), 0.0, id, detail);
+    }
+    static void end(const char *name, const char *cat, unsigned long id)
+    {
+	if (enabled())
+	    event(name, cat, 'e', now(), 0.0, id, 0);
+    }
+};
+
+// A TraceScope records the time from its construction to its
+// destruction.  NAME and CAT must be static strings.
+class TraceScope {
+private:
+    const char *name;
+    const char *cat;
+    double start;
+
+    TraceScope(const TraceScope&);
+    TraceScope& operator = (const TraceScope&);
+
+public:
+    TraceScope(const char *n, const char *c = "ddd")
+	: name(n), cat(c), start(TraceEvents::enabled() ?
+				 TraceEvents::now() : -1.0)
+    {}
+
+    ~TraceScope()
+    {
+	if (start >= 0.0)
+	    TraceEvents::complete(name, cat, start);
+    }
+};
+
+#endif // _DDD_TraceEvents_h
+// DON'T ADD ANYTHING BEHIND THIS #endif
@@ -38,5 +38,17 @@ inline unsigned int multiplicativehash(int x)
 
 unsigned int foldhash(double);
 
+// 64-bit FNV-1a hash, suitable for comparing contents.  H is the
+// hash to continue from.
+const unsigned long long FNV_BASIS = 14695981039346656037ULL;
+
+unsigned long long fnvhash(const char *x, int len, 
+			   unsigned long long h = FNV_BASIS);
+
+inline unsigned long long fnvhash(unsigned long long x, unsigned long long h)
+{
+    return fnvhash((const char *)&x, sizeof(x), h);
+}
+
 #endif // _DDD_hash_h
 // DON'T ADD ANYTHING BEHIND THIS #endif
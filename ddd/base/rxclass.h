@@ -62,6 +62,9 @@ protected:
     regex_t compiled;		// "^" + regexp
     char prefix[32];		// constant prefix (for faster search)
 
+    regex_t unanchored;		// regexp, for searching in one pass
+    bool searchable;		// True iff UNANCHORED is compiled
+
     regmatch_t *exprs;		// Matched expressions
     size_t nexprs() const;	// Number of expressions
 
@@ -70,6 +73,9 @@ protected:
 
     // Create a prefix from T and FLAGS
     static char get_prefix(const char *& t, int flags);
+
+    // True iff T matches the same anywhere in a string as at its start
+    static bool context_free(const char *t);
 #endif
 
     // For regexes supplying their own function
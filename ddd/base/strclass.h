@@ -400,6 +400,19 @@ License along with this library; if not, see <http://www.gnu.org/licenses/>.
 //     // S0 still points to original S here
 // 
 // This feature is used in DDD to speed up several loops.
+//
+// Short strings are kept within the string object itself; only longer
+// strings are allocated on the heap.  Moving a string (as in
+// `return s' or `v.push_back(std::move(s))') passes its heap memory
+// on instead of copying it.
+//
+// A `stringView' refers to the characters of a string, subString, or
+// `const char *' without copying them:
+//
+//     stringView name(value + start, len);
+//     if (name == "record") ...
+//
+// Use `string(view)' to get a copy.
 
 
 #ifndef _ICE_strclass_h
@@ -407,6 +420,8 @@ License along with this library; if not, see <http://www.gnu.org/licenses/>.
 
 #include <iostream>
 #include <sstream>
+#include <stddef.h>
+#include <string.h>
 #include "rxclass.h"
 #include "config.h"
 #include "bool.h"
@@ -418,6 +433,12 @@ License along with this library; if not, see <http://www.gnu.org/licenses/>.
 #define STRING_CHECK_CONSUME 0
 #endif
 
+// Extra space within each string object.  Strings that fit
+// (22 characters on LP64 hosts) need no heap allocation.
+#ifndef STRING_LOCAL_SIZE
+#define STRING_LOCAL_SIZE 16
+#endif
+
 // Internal string representations
 struct strRep
 {
@@ -425,6 +446,8 @@ struct strRep
     unsigned int allocated;     // Allocated space
     char *s;			// Start of string; points into
 				// MEM[0]..MEM[ALLOCATED - 1]
+    bool local;			// True if not on the heap; such reps
+				// are never deleted
     char mem[1];                // Start of memory
     				// (at least 1 char for trailing null)
 				// Allocated & expanded via non-public fcts
@@ -449,6 +472,7 @@ strRep* string_Scapitalize(strRep*, strRep*);
 class string;
 class subString;
 class constSubString;
+class stringView;
 
 class constSubString
 {
@@ -555,6 +579,15 @@ protected:
     bool consume;	 // If true, check that we're only consuming
 #endif
 
+    // Representation for short strings, kept within the string object
+    struct localRep {
+	strRep head;
+	char more[STRING_LOCAL_SIZE];
+    } local;
+
+    // Reset the local representation to the empty string; return it
+    strRep* local_rep();
+
     // Some helper functions
     int search(int, int, const char*, int = -1) const;
     int search(int, int, char) const;
@@ -578,6 +611,8 @@ public:
     string(const char* t, int len);
     string(char c);
     string(std::ostringstream& os); // should be const
+    string(string&& x) noexcept;
+    explicit string(const stringView& x);
 
     ~string();
 
@@ -591,6 +626,8 @@ public:
     string& operator = (const subString& y);
     string& operator = (const constSubString& y);
     string& operator = (std::ostringstream& os);
+    string& operator = (string&& y) noexcept;
+    string& operator = (const stringView& y);
 
     // Concatenation
     string& operator += (const string& y); 
@@ -599,6 +636,7 @@ public:
     string& operator += (const char* t);
     string& operator += (char* t);
     string& operator += (char c);
+    string& operator += (const stringView& y);
 
     string& prepend(const string& y); 
     string& prepend(const subString& y);
@@ -884,6 +922,37 @@ public:
 // associated with a class of which the function is a friend.
 string replicate(char c, int n);
 
+
+// A stringView refers to characters held elsewhere, such as in a
+// string or subString, without copying them.  It remains valid only
+// as long as these characters are unchanged.
+class stringView
+{
+private:
+    const char *s;		// Start of characters
+    unsigned int len;		// Number of characters
+
+public:
+    stringView();
+    stringView(const char *t);
+    stringView(const char *t, int tlen);
+    stringView(const string& x);
+    stringView(const subString& x);
+    stringView(const constSubString& x);
+
+    // Status
+    unsigned int length() const;
+    bool empty() const;
+    const char* chars() const;	// Not necessarily null-terminated
+
+    char operator [] (int i) const;
+
+    // Comparison
+    int compare(const stringView& y) const;
+    bool operator == (const stringView& y) const;
+    bool operator != (const stringView& y) const;
+};
+
 #if 0
 typedef string strTmp; // for backward compatibility
 #endif
@@ -939,54 +1008,87 @@ inline bool string::consuming() const
 }
 
 // Constructors
+inline strRep* string::local_rep()
+{
+    local.head.len       = 0;
+    local.head.allocated = sizeof(local) - offsetof(strRep, mem) - 1;
+    local.head.s         = &(local.head.mem[0]);
+    local.head.local     = true;
+    local.head.mem[0]    = '\0';
+    return &local.head;
+}
+
 inline string::string() 
-  : rep(&_nilstrRep)
 #if STRING_CHECK_CONSUME
-    , consume(false) 
+  : consume(false) 
 #endif
-  {}
+{
+    rep = local_rep();
+}
 
 inline string::string(const string& x)
-  : rep(string_Scopy(0, x.rep))
 #if STRING_CHECK_CONSUME
-    , consume(false) 
+  : consume(false) 
 #endif
-  {}
+{
+    rep = string_Scopy(local_rep(), x.rep);
+}
 
 inline string::string(const char* t) 
-  : rep(string_Salloc(0, t, -1, -1))
 #if STRING_CHECK_CONSUME
-    , consume(false) 
+  : consume(false) 
 #endif
-  {}
+{
+    rep = string_Salloc(local_rep(), t, -1, -1);
+}
 
 inline string::string(const char* t, int tlen)
-  : rep(string_Salloc(0, t, tlen, tlen))
 #if STRING_CHECK_CONSUME
-    , consume(false) 
+  : consume(false) 
 #endif
-  {}
+{
+    rep = string_Salloc(local_rep(), t, tlen, tlen);
+}
 
 inline string::string(const subString& y)
-  : rep(string_Salloc(0, y.chars(), y.length(), y.length()))
 #if STRING_CHECK_CONSUME
-    , consume(false) 
+  : consume(false) 
 #endif
-  {}
+{
+    rep = string_Salloc(local_rep(), y.chars(), y.length(), y.length());
+}
 
 inline string::string(const constSubString& y)
-  : rep(string_Salloc(0, y.chars(), y.length(), y.length()))
 #if STRING_CHECK_CONSUME
-    , consume(false)
+  : consume(false)
 #endif
-  {}
+{
+    rep = string_Salloc(local_rep(), y.chars(), y.length(), y.length());
+}
 
 inline string::string(char c) 
-  : rep(string_Salloc(0, &c, 1, 1))
 #if STRING_CHECK_CONSUME
-    , consume(false) 
+  : consume(false) 
 #endif
-  {}
+{
+    rep = string_Salloc(local_rep(), &c, 1, 1);
+}
+
+// Moving takes over X's representation if it is on the heap.  Short
+// strings are copied.
+inline string::string(string&& x) noexcept
+#if STRING_CHECK_CONSUME
+  : consume(false) 
+#endif
+{
+    if (x.rep->local)
+	rep = string_Scopy(local_rep(), x.rep);
+    else
+    {
+	rep = x.rep;
+	x.rep = x.local_rep();
+    }
+}
 
 
 // For HAVE_PLACEMENT_NEW, if using placement new, use operator
@@ -996,6 +1098,9 @@ inline string::string(char c)
 // was flagging this and it does result in undefined behavior.
 inline void string_DeleteRep(strRep *rep)
 {
+    if (rep->local)
+	return;
+
 #if HAVE_PLACEMENT_NEW
     operator delete(rep);
 #else
@@ -1005,8 +1110,7 @@ inline void string_DeleteRep(strRep *rep)
 
 inline string::~string()
 {
-    if (rep != &_nilstrRep)
-	string_DeleteRep(rep);
+    string_DeleteRep(rep);
 }
 
 inline subString::subString(const subString& x)
@@ -1144,14 +1248,29 @@ inline string& string::operator = (std::ostringstream& os)
 }
 
 inline string::string(std::ostringstream& os)
-    : rep(&_nilstrRep)
 #if STRING_CHECK_CONSUME
-    , consume(false) 
+    : consume(false) 
 #endif
 {
+    rep = local_rep();
     operator=(os);
 }
 
+inline string& string::operator = (string&& y) noexcept
+{
+    if (y.empty() || y.rep->local)
+	return operator = ((const string&)y);
+
+    assert(!consuming());
+    if (y.rep != rep)
+    {
+	string_DeleteRep(rep);
+	rep = y.rep;
+	y.rep = y.local_rep();
+    }
+    return *this;
+}
+
 
 // Substring assignments
 
@@ -2004,5 +2123,79 @@ inline constSubString string::_substr(int first, int len) const
 	return constSubString(*this, first, len);
 }
 
+// Views
+
+inline stringView::stringView()
+  : s(""), len(0) {}
+inline stringView::stringView(const char *t)
+  : s(t), len(strlen(t)) {}
+inline stringView::stringView(const char *t, int tlen)
+  : s(t), len(tlen) {}
+inline stringView::stringView(const string& x)
+  : s(x.chars()), len(x.length()) {}
+inline stringView::stringView(const subString& x)
+  : s(x.chars()), len(x.length()) {}
+inline stringView::stringView(const constSubString& x)
+  : s(x.chars()), len(x.length()) {}
+
+inline unsigned int stringView::length() const { return len; }
+inline bool         stringView::empty() const { return len == 0; }
+inline const char*  stringView::chars() const { return s; }
+
+inline char stringView::operator [] (int i) const
+{
+    assert(unsigned(i) < len);
+    return s[i];
+}
+
+inline int stringView::compare(const stringView& y) const
+{
+    int diff = memcmp(s, y.s, len < y.len ? len : y.len);
+    if (diff != 0)
+	return diff;
+    return int(len) - int(y.len);
+}
+
+inline bool stringView::operator == (const stringView& y) const
+{
+    return len == y.len && memcmp(s, y.s, len) == 0;
+}
+
+inline bool stringView::operator != (const stringView& y) const
+{
+    return !operator == (y);
+}
+
+inline string::string(const stringView& y)
+#if STRING_CHECK_CONSUME
+  : consume(false) 
+#endif
+{
+    rep = string_Salloc(local_rep(), y.chars(), y.length(), y.length());
+}
+
+inline string& string::operator = (const stringView& y)
+{
+    if (y.empty())
+    {
+	// Assignment of empty view
+	rep->s += rep->len;
+	rep->len = 0;
+    }
+    else
+    {
+	assert(!consuming());
+	rep = string_Salloc(rep, y.chars(), y.length(), y.length());
+    }
+    return *this;
+}
+
+inline string& string::operator += (const stringView& y)
+{
+    assert(!consuming());
+    rep = string_Scat(rep, chars(), length(), y.chars(), y.length());
+    return *this;
+}
+
 #endif // _ICE_strclass_h
 // DON'T ADD ANYTHING BEHIND THIS #endif
@@ -46,6 +46,7 @@
 #include "BoxExtend.h"
 #include "base/PrintGC.h"
 #include "x11/Widget.h"
+#include <X11/X.h>
 #include "base/bool.h"
 #include "base/UniqueId.h"
 #include "DataLink.h"
@@ -165,6 +166,10 @@ public:
     // Propagate new font
     virtual void newFont(const string&) { resize(); }
 
+    // Drawable to draw into: the window of W, unless TARGET is set
+    static Drawable target;
+    static Drawable drawable(Widget w);
+
     // Draw
     void draw(Widget w, 
 	      const BoxRegion& region, 
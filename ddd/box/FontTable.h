@@ -32,6 +32,7 @@
 
 #if HAVE_FREETYPE
 #include <X11/Xft/Xft.h>
+#include <map>
 #endif
 #include <X11/Xlib.h>
 #include "base/strclass.h"
@@ -47,6 +48,22 @@ typedef XFontStruct BoxFont;
 
 #define MAX_FONTS 511 /* Max #Fonts */
 
+#if HAVE_FREETYPE
+// Glyph index and advance of a character
+struct FontGlyph {
+    FT_UInt index;
+    int advance;
+
+    FontGlyph(): index(0), advance(-1) {}
+};
+
+// Glyphs of a font, as far as we have looked them up
+struct FontGlyphs {
+    FontGlyph latin1[256];		// Characters 0..255
+    std::map<FcChar32, FontGlyph> other; // All others
+};
+#endif
+
 struct FontTableHashEntry {
     BoxFont *font;
     string name;
@@ -66,6 +83,10 @@ private:
     FontTableHashEntry table[MAX_FONTS];
     Display *_display;
 
+#if HAVE_FREETYPE
+    std::map<const BoxFont *, FontGlyphs> glyphs;
+#endif
+
     FontTable(const FontTable&);
     FontTable& operator = (const FontTable&);
 
@@ -92,6 +113,14 @@ public:
     BoxFont *operator[](const string& name);
 
     Display *getDisplay() {return _display;}
+
+#if HAVE_FREETYPE
+    // Glyph for character C in FONT
+    const FontGlyph& glyph(BoxFont *font, FcChar32 c);
+
+    // Width of the UTF-8 text S (LENGTH bytes) in FONT
+    int width(BoxFont *font, const char *s, int length);
+#endif
 };
 
 #endif
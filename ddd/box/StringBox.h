@@ -125,6 +125,15 @@ public:
     Box *resize();
 
     bool isStringBox() const { return true; }
+
+    // Draw all strings drawn so far in W.  With FreeType, strings
+    // are collected and drawn in one batch at the end of Box::draw();
+    // boxes that paint over what has been drawn before must call this
+    // first.
+    static void flush(Widget w);
+
+    // Release resources for drawing into D (say, before freeing a pixmap)
+    static void forget(Drawable d);
 };
 
 #endif
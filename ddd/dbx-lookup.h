@@ -32,6 +32,12 @@
 
 // Find location of FUNC_NAME using DBX
 string dbx_lookup(const string& func_name, bool silent = true);
+
+// Same, but asynchronously: PROC is called with the location and DATA
+// as soon as it is known
+typedef void (*DBXLookupProc)(const string& pos, void *data);
+void dbx_lookup(const string& func_name, DBXLookupProc proc, void *data = 0,
+		bool silent = true);
 void clear_dbx_lookup_cache();
 
 // Find path of source file SOURCE
@@ -68,6 +68,9 @@ public:
     // Printing
     void _print(std::ostream& os, const GraphGC &gc) const;
 
+    // Region containing everything drawn for this edge
+    virtual BoxRegion boundingRegion(const GraphGC& gc) const;
+
     // Duplicator
     GraphEdge *dup() const
     {
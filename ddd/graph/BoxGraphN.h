@@ -32,6 +32,8 @@
 #include "box/Box.h"
 #include "box/MarkBox.h"
 
+#include <X11/Xlib.h>
+
 class BoxGraphNode: public RegionGraphNode {
 public:
     DECLARE_TYPE_INFO
@@ -40,8 +42,19 @@ private:
     Box *_box;		 // the box
     MarkBox *_highlight; // box to be highlighted when selected
 
+    // Rendering of the box (if GraphGC::cacheNodes is set)
+    mutable Display *_cache_display;
+    mutable Pixmap _cache;
+    mutable BoxSize _cache_size;
+    mutable GC _cache_gc;	// GCs and colors used for rendering
+    mutable GC _cache_clear_gc;
+    mutable bool _cache_color;
+
     BoxGraphNode& operator = (const BoxGraphNode&);
 
+    // Draw the box via the cached rendering
+    void drawCached(Widget w, const GraphGC& gc) const;
+
 protected:
     // Draw
     virtual void forceDraw(Widget w, 
@@ -60,13 +73,17 @@ public:
 		 MarkBox *h = 0)
 	: RegionGraphNode(initialPos, b->size()),
 	  _box(b->link()),
-	  _highlight(h)
+	  _highlight(h),
+	  _cache_display(0), _cache(None), _cache_size(),
+	  _cache_gc(0), _cache_clear_gc(0), _cache_color(false)
     {}
 
     BoxGraphNode()
 	: RegionGraphNode(),
 	  _box(0),
-	  _highlight(0)
+	  _highlight(0),
+	  _cache_display(0), _cache(None), _cache_size(),
+	  _cache_gc(0), _cache_clear_gc(0), _cache_color(false)
     {}
 
     GraphNode *dup() const
@@ -77,10 +94,14 @@ public:
     // Destructor
     virtual ~BoxGraphNode()
     {
+	flushCache();
 	if (_box)
 	    _box->unlink();
     }
 
+    // Discard the cached rendering
+    virtual void flushCache() const;
+
     // Attributes
     Box *box() const           { return _box; }
     MarkBox *highlight() const { return _highlight; }
@@ -35,6 +35,10 @@
 #include "box/Box.h"
 #include "base/TypeInfo.h"
 
+#include <vector>
+
+class GraphIndex;
+
 class Graph {
 public:
     DECLARE_TYPE_INFO
@@ -42,6 +46,7 @@ public:
 private:
     GraphNode *_firstNode;	// circular list (0 if empty)
     GraphEdge *_firstEdge;	// circular list (0 if empty)
+    mutable GraphIndex *_index;	// spatial index (0 if not built)
 
     Graph& operator = (const Graph&);
 
@@ -51,6 +56,10 @@ private:
 		     unsigned short blue) const;
     void end_color(std::ostream& os, const PrintGC& gc) const;
 
+    // Spatial index
+    const GraphIndex& index(const GraphGC& gc) const;
+    void invalidateIndex();
+
 
 protected:
     void addNodes(GraphNode* nodes);
@@ -72,7 +81,7 @@ protected:
 public:
     // Constructors
     Graph():
-	_firstNode(0), _firstEdge(0)
+	_firstNode(0), _firstEdge(0), _index(0)
     {}
 
     // Destructor
@@ -160,6 +169,20 @@ public:
     GraphEdge *firstVisibleEdge() const;
     GraphEdge *nextVisibleEdge(GraphEdge *ref) const;
 
+    // Visible nodes and edges whose regions (as to GC) intersect R,
+    // in list order
+    void visibleNodes(const BoxRegion& r, const GraphGC& gc,
+		      std::vector<GraphNode *>& nodes) const;
+    void visibleEdges(const BoxRegion& r, const GraphGC& gc,
+		      std::vector<GraphEdge *>& edges) const;
+
+    // Last visible node whose sensitive region contains P (0 if none)
+    GraphNode *visibleNodeAt(const BoxPoint& p, const GraphGC& gc) const;
+
+    // Notification: region of NODE or EDGE has changed
+    void regionChanged(const GraphNode *node);
+    void regionChanged(const GraphEdge *edge);
+
     // Change position in node list
     void makeNodeFirst(GraphNode *node);
     void makeNodeLast(GraphNode *node);
@@ -80,6 +80,9 @@ protected:
     // Dequeue from node lists
     void dequeue();
 
+    // Notify graph that the region has changed
+    void regionChanged();
+
     // Copy Constructor
     GraphEdge(const GraphEdge& edge):
 	_id(),
@@ -134,6 +137,13 @@ public:
     // Region occupied by edge - if none, BoxRegion()
     virtual BoxRegion region(const GraphGC&) const { return BoxRegion(); }
 
+    // Region containing everything drawn for this edge - if unknown,
+    // BoxRegion()
+    virtual BoxRegion boundingRegion(const GraphGC&) const
+    {
+	return BoxRegion();
+    }
+
     // Representation invariant
     virtual bool OK() const;
 };
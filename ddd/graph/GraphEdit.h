@@ -50,6 +50,7 @@ class GraphNode;
 #define XtNshowAnnotations          "showAnnotations"
 #define XtNhintSize                 "hintSize"
 #define XtNopaqueMove               "opaqueMove"
+#define XtNdoubleBuffer             "doubleBuffer"
 #define XtNautoRaise                "autoRaise"
 #define XtNgridWidth                "gridWidth"
 #define XtNgridHeight               "gridHeight"
@@ -108,6 +109,7 @@ class GraphNode;
 #define XtCShowAnnotations   "ShowAnnotations"
 #define XtCHintSize          "HintSize"
 #define XtCOpaqueMove        "OpaqueMove"
+#define XtCDoubleBuffer      "DoubleBuffer"
 #define XtCAutoRaise         "AutoRaise"
 #define XtCGridSize          "GridSize"
 #define XtCExtraSize         "ExtraSize"
@@ -85,6 +85,9 @@ typedef struct _GraphEditPart {
     Boolean rubberAnnotations;	// Draw annotations when moving
     Boolean opaqueMove;		// Draw nodes  when moving
 
+    // Drawing stuff
+    Boolean doubleBuffer;	// Draw nodes via cached pixmaps?
+
     // Selection stuff
     Boolean autoRaise;		// Raise selected nodes?
 
@@ -78,6 +78,8 @@ class GraphGC {
     SelfEdgePosition  selfEdgePosition;  // Its position relative to the node
     SelfEdgeDirection selfEdgeDirection; // Its direction
 
+    bool           cacheNodes;       // Flag: draw nodes via pixmaps?
+
     // Printing stuff
     PrintGC     *printGC;               // Graphics context for printing
     bool        printSelectedNodesOnly; // Flag: print selected nodes only?
@@ -111,6 +113,7 @@ class GraphGC {
 	selfEdgeDiameter(32),
 	selfEdgePosition(NorthEast),
 	selfEdgeDirection(Counterclockwise),
+	cacheNodes(false),
 	printGC(&defaultPrintGC),
 	printSelectedNodesOnly(false),
 	edge_red(0),
@@ -140,6 +143,7 @@ class GraphGC {
 	selfEdgeDiameter(g.selfEdgeDiameter),
 	selfEdgePosition(g.selfEdgePosition),
 	selfEdgeDirection(g.selfEdgeDirection),
+	cacheNodes(g.cacheNodes),
 	printGC(g.printGC),
 	printSelectedNodesOnly(g.printSelectedNodesOnly),
 	edge_red(g.edge_red),
@@ -172,6 +176,7 @@ class GraphGC {
 	    selfEdgeDiameter       = g.selfEdgeDiameter;
 	    selfEdgePosition       = g.selfEdgePosition;
 	    selfEdgeDirection      = g.selfEdgeDirection;
+	    cacheNodes             = g.cacheNodes;
 	    printGC                = g.printGC;
 	    printSelectedNodesOnly = g.printSelectedNodesOnly;
 	    edge_red               = g.edge_red;
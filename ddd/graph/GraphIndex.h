@@ -0,0 +1,129 @@
+// $Id$ -*- C++ -*-
+// GraphIndex class: spatial index over graph nodes and edges
+
+// Copyright (C) 2026 Free Software Foundation, Inc.
+//
+// This file is part of DDD.
+//
+// DDD is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public
+// License as published by the Free Software Foundation; either
+// version 3 of the License, or (at your option) any later version.
+//
+// DDD is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+// See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public
+// License along with DDD -- see the file COPYING.
+// If not, see <http://www.gnu.org/licenses/>.
+//
+// DDD is the data display debugger.
+// For details, see the DDD World-Wide-Web page,
+// `http://www.gnu.org/software/ddd/',
+// or send a mail to the DDD developers <ddd@gnu.org>.
+
+#ifndef _DDD_GraphIndex_h
+#define _DDD_GraphIndex_h
+
+// A GraphIndex maps the regions of a graph's nodes and edges to grid
+// cells, such that we can find the nodes and edges within a region
+// without looking at all of them.  Queries return candidates only;
+// callers check the exact regions themselves.
+
+#include "GraphGC.h"
+#include "box/BoxRegion.h"
+#include "base/TypeInfo.h"
+
+#include <vector>
+#include <unordered_map>
+
+class GraphNode;
+class GraphEdge;
+
+// Grid over items of type T
+template<class T>
+class RegionGrid {
+public:
+    struct Entry {
+	const T *item;
+	BoxRegion region;	// Bounding region; invalid if unbounded
+	int rank;		// Position in graph list
+	std::vector<long long> cells;
+
+	Entry(): item(0), region(), rank(0), cells() {}
+    };
+
+private:
+    std::unordered_map<const T *, Entry> entries;
+    std::unordered_map<long long, std::vector<Entry *> > cells;
+    std::vector<Entry *> unbounded;
+    int min_rank, max_rank;
+
+    void add(Entry *e);
+    void remove(Entry *e);
+
+public:
+    RegionGrid(): entries(), cells(), unbounded(), min_rank(0), max_rank(0)
+    {}
+
+    void insert(const T *item, const BoxRegion& region, int rank);
+    void update(const T *item, const BoxRegion& region);
+
+    // Make ITEM first (or last) in rank
+    void reorder(const T *item, bool last);
+
+    // Append items whose region may intersect R to ITEMS, by rank
+    void query(const BoxRegion& r, std::vector<const T *>& items) const;
+};
+
+class GraphIndex {
+public:
+    DECLARE_TYPE_INFO
+
+private:
+    GraphGC gc;			// GC the index was built for
+
+    RegionGrid<GraphNode> nodes;
+    RegionGrid<GraphEdge> edges;
+
+    GraphIndex(const GraphIndex&);
+    GraphIndex& operator = (const GraphIndex&);
+
+public:
+    // Constructor
+    GraphIndex(const GraphGC& g):
+	gc(g), nodes(), edges()
+    {}
+
+    // Check whether the index is valid for G
+    bool fits(const GraphGC& g) const;
+
+    // Add NODE or EDGE at list position RANK
+    void insert(const GraphNode *node, int rank);
+    void insert(const GraphEdge *edge, int rank);
+
+    // Note changed region of NODE (and its edges)
+    void update(const GraphNode *node);
+
+    // Note changed region of EDGE
+    void update(const GraphEdge *edge);
+
+    // Note that NODE or EDGE has become first (or last) in list
+    void reorder(const GraphNode *node, bool last) { nodes.reorder(node, last); }
+    void reorder(const GraphEdge *edge, bool last) { edges.reorder(edge, last); }
+
+    // Get candidates within R, in list order
+    void query(const BoxRegion& r, std::vector<const GraphNode *>& ns) const
+    {
+	nodes.query(r, ns);
+    }
+    void query(const BoxRegion& r, std::vector<const GraphEdge *>& es) const
+    {
+	edges.query(r, es);
+    }
+};
+
+#endif // _DDD_GraphIndex_h
+// DON'T ADD ANYTHING BEHIND THIS #endif
@@ -62,6 +62,9 @@ private:
     GraphNode& operator = (const GraphNode&);
 
 protected:
+    // Notify graph that the region has changed
+    void regionChanged();
+
     // Copy Constructor
     GraphNode(const GraphNode& node):
 	_id(),
@@ -150,6 +153,12 @@ public:
 	// Default: do nothing
     }
 
+    // Discard cached drawings, if any
+    virtual void flushCache() const
+    {
+	// Default: do nothing
+    }
+
     // Custom drawing functions
     void draw(Widget w, const BoxRegion& exposed) const
     {
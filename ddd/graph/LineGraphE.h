@@ -115,6 +115,7 @@ public:
 	{
 	    delete _annotation;
 	    _annotation = a;
+	    regionChanged();
 	}
     }
 
@@ -140,6 +141,9 @@ public:
 
     // Region occupied by edge - if none, BoxRegion()
     virtual BoxRegion region(const GraphGC&) const;
+
+    // Region containing everything drawn for this edge
+    virtual BoxRegion boundingRegion(const GraphGC& gc) const;
 };
 
 #endif // _DDD_LineGraphEdge_h
@@ -61,7 +61,10 @@ public:
     virtual void moveTo(const BoxPoint& newPos)
     {
 	if (_pos != newPos && MoveCB(this, newPos))
+	{
 	    _pos = newPos;
+	    regionChanged();
+	}
     }
 
     // Attributes
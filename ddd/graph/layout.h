@@ -96,6 +96,8 @@ struct _NODE {
     int loop;               /* flag for loop */
     int index;              /* auxilliary */
     NODE *mark;             /* auxilliary */
+    int leftwidth;          /* space taken by the nodes to the left */
+    bool dirty;             /* flag: must be placed again? */
 
     NODE *left;             /* same level - to the left */
     NODE *right;            /* same level - to the right */
@@ -177,6 +179,9 @@ public:
     static NODE *graphEnterNode(GRAPH *graph, const ID *id, NODETYPE type);
     static NODE *graphGetNode(GRAPH *graph, const ID *id, NODETYPE type);
     static void graphRemoveNode(GRAPH *graph, const ID *id, NODETYPE type);
+    static void graphRemoveHints(GRAPH *graph, NODE *node, EDGE *edge,
+				 int direction);
+    static void graphReset(GRAPH *graph);
     static void graphCreateLevels(GRAPH *graph, int n);
     static void graphRemoveLevels(GRAPH *graph);
     static void graphAddLevels(GRAPH *graph, int n);
@@ -194,6 +199,8 @@ public:
     static void graphTabInit(GRAPHTAB *tab);
     static void levelsInsertNode(GRAPH *graph, NODE *node, int n);
     static void levelsRemoveNode(GRAPH *graph, NODE *node, int n);
+    static void levelsInsertSorted(GRAPH *graph, NODE *node, int n);
+    static void levelsLeftWidth(NODE **level, int dist);
     static void levelsEnterNodes(GRAPH *graph, bool pullup);
     static void levelsIndex(NODE **level);
     static int levelsLength(NODE **level);
@@ -225,6 +232,14 @@ public:
     static int sortCmpLowerPrio(NODE **fst, NODE **snd);
     static int sortLevelVertical(NODE **level, int miny, int minydist);
     static void sortGraphVertical(GRAPH *graph);
+    static bool incLiftNode(GRAPH *graph, NODE *node, int n);
+    static int incPreferredX(NODE *node, NODE **level, int dist);
+    static int incFreeX(NODE *node, NODE **level, int x, int dist);
+    static int incOverlap(NODE *left, NODE *right, int dist);
+    static int incCountMoves(NODE *node, int amount, int dist, int direction);
+    static void incPlaceLevel(GRAPH *graph, NODE **level);
+    static int incLevelVertical(NODE **level, int miny, int minydist);
+    static void incGraphVertical(GRAPH *graph);
 };
 
 #endif // _DDD_layout_h
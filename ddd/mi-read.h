@@ -0,0 +1,96 @@
+// $Id$ -*- C++ -*-
+// Read GDB/MI output records
+
+// Copyright (C) 2026 Free Software Foundation, Inc.
+//
+// This file is part of DDD.
+//
+// DDD is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public
+// License as published by the Free Software Foundation; either
+// version 3 of the License, or (at your option) any later version.
+//
+// DDD is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+// See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public
+// License along with DDD -- see the file COPYING.
+// If not, see <http://www.gnu.org/licenses/>.
+//
+// DDD is the data display debugger.
+// For details, see the DDD World-Wide-Web page,
+// `http://www.gnu.org/software/ddd/',
+// or send a mail to the DDD developers <ddd@gnu.org>.
+
+//-----------------------------------------------------------------------------
+// Read GDB/MI output records, as issued by `interpreter-exec mi'
+//-----------------------------------------------------------------------------
+
+#ifndef _DDD_mi_read_h
+#define _DDD_mi_read_h
+
+#include "base/strclass.h"
+#include "base/bool.h"
+
+#include <vector>
+
+// A GDB/MI value: either a constant (a C string), a tuple
+// `{NAME=VALUE,...}', or a list `[VALUE,...]' or `[NAME=VALUE,...]'.
+class MIValue {
+public:
+    enum Kind { Const, Tuple, List };
+
+private:
+    Kind _kind;
+    string _value;			// Const value
+    std::vector<string> _names;		// Tuple/List member names
+    std::vector<MIValue *> _members;	// Tuple/List members
+
+    MIValue(const MIValue&);
+    MIValue& operator = (const MIValue&);
+
+public:
+    MIValue(Kind k = Tuple)
+	: _kind(k), _value(), _names(), _members()
+    {}
+
+    ~MIValue()
+    {
+	clear();
+    }
+
+    // Delete all members
+    void clear();
+
+    Kind kind() const           { return _kind; }
+    void kind(Kind k)           { _kind = k; }
+    const string& value() const { return _value; }
+    string& value()             { return _value; }
+
+    // Tuple and list members.  Names are empty in value lists.
+    int length() const                   { return _members.size(); }
+    const string& name(int i) const      { return _names[i]; }
+    const MIValue *member(int i) const   { return _members[i]; }
+    void add(const string& name, MIValue *v)
+    {
+	_names.push_back(name);
+	_members.push_back(v);
+    }
+
+    // Return the first member named NAME; 0 if none
+    const MIValue *get(const char *name) const;
+
+    // Return the value of the constant named NAME; DEFAULT_VALUE if none
+    string get_const(const char *name, const char *default_value = "") const;
+};
+
+// Read a GDB/MI result record `^CLASS,RESULTS' from ANSWER, skipping
+// any preceding stream and async records.  Store RESULTS as members of
+// the tuple RESULTS and return CLASS (`done', `error', ...).  Return
+// "" if ANSWER contains no result record.
+string read_mi_result(const string& answer, MIValue& results);
+
+#endif // _DDD_mi_read_h
+// DON'T ADD ANYTHING BEHIND THIS #endif
@@ -31,12 +31,38 @@
 #include "base/strclass.h"
 #include "base/bool.h"
 
+#include <vector>
+
 // Send COMMAND to GDB; return answer (NO_GDB_ANSWER if none)
 // TIMEOUT is either 0 (= use default timeout), -1 (= no timeout)
 // or maximal time in seconds
 string gdb_question(const string& command, int timeout = 0, 
 		    bool verbatim = false);
 
+// Send COMMANDS to GDB as one pipelined batch; wait for all answers
+// and store them in ANSWERS, in the order of COMMANDS.  TIMEOUT is
+// as in gdb_question().
+void gdb_questions(const std::vector<string>& commands,
+		   std::vector<string>& answers, int timeout = 0);
+
+// Asynchronous questions.  These return at once; PROC is called
+// with DATA as soon as the answer is in.  If GDB cannot be asked, the
+// answer is NO_GDB_ANSWER, and PROC may be called right away.
+
+// Ask COMMAND, after all commands queued so far
+typedef void (*GDBAnswerProc)(const string& answer, void *data);
+void gdb_ask(const string& command, GDBAnswerProc proc, void *data = 0);
+
+// Ask COMMANDS, after all commands queued so far.  If nothing is
+// queued, the questions are pipelined.  ANSWERS are in the order of
+// COMMANDS.  If FIRST is set, ask COMMANDS before all queued
+// commands instead; this is meant for follow-up questions asked from
+// within an answer callback.
+typedef void (*GDBAnswersProc)(const std::vector<string>& answers,
+			       void *data);
+void gdb_ask(const std::vector<string>& commands, GDBAnswersProc proc, 
+	     void *data = 0, bool first = false);
+
 const string NO_GDB_ANSWER(char(-1));
 
 extern bool gdb_question_running; // Is gdb_question running?
@@ -29,8 +29,15 @@
 #ifndef _DDD_Assoc_h
 #define _DDD_Assoc_h
 
+// An Assoc maps keys to values.  Entries are kept in a doubly linked
+// list (most recently inserted first), which determines the iteration
+// order.  Lookups go through an open-addressing hash table (linear
+// probing) over the list entries; the table is only built once the
+// Assoc has grown beyond a few entries.
+
 #include "base/bool.h"
 #include "base/assert.h"
+#include "base/strclass.h"
 
 #include <stdlib.h>		// abort()
 
@@ -39,14 +46,54 @@ template<class K, class V> class _Assoc;
 template<class K, class V> class Assoc;
 template<class K, class V> class AssocIter;
 
+
+// Hash functions for keys.  Add an overload for new key types.
+inline unsigned long assoc_hash(const string& s)
+{
+    // FNV-1a
+    unsigned long h = 2166136261UL;
+    const char *p = s.chars();
+    for (int i = s.length(); i > 0; i--)
+    {
+	h ^= (unsigned char)*p++;
+	h *= 16777619UL;
+    }
+    return h;
+}
+
+inline unsigned long assoc_hash(long n)
+{
+    unsigned long h = (unsigned long)n;
+    h ^= h >> 16;
+    h *= 0x45d9f3bUL;
+    h ^= h >> 16;
+    return h;
+}
+
+inline unsigned long assoc_hash(int n)
+{
+    return assoc_hash(long(n));
+}
+
+template<class T>
+inline unsigned long assoc_hash(T *p)
+{
+    // Ignore alignment bits
+    return assoc_hash(long((unsigned long)p >> 3));
+}
+
+
 template<class K, class V>
 class AssocRec {
     friend class _Assoc<K,V>;
     friend class Assoc<K,V>;
     friend class AssocIter<K,V>;
+    template<class K2, class C2> friend class Map;
 
 private:
     AssocRec<K,V> *next;		// For Assoc usage only
+    AssocRec<K,V> *prev;		// For Assoc usage only
+    unsigned long hash;			// Hash code of KEY
 
 public:
     K key;
@@ -54,10 +101,10 @@ public:
     
     // Constructor
     AssocRec(const K& k, const V& v)
-	: next(0), key(k), value(v)
+	: next(0), prev(0), hash(assoc_hash(k)), key(k), value(v)
     {}
     AssocRec(const K& k)
-	: next(0), key(k)
+	: next(0), prev(0), hash(assoc_hash(k)), key(k)
     {}
 
 private:
@@ -72,20 +119,168 @@ class _Assoc {
 protected:
     AssocRec<K,V> *entries;	// Entries
 
-    virtual AssocRec<K,V> *lookup(const K& key) const
+private:
+    AssocRec<K,V> **table;	// Hash table (0 if not built yet)
+    int table_size;		// Size of TABLE; always a power of 2
+    int table_used;		// Non-empty slots in TABLE, including removed
+    int count;			// Number of entries
+
+    // Build the table only if we have more entries than this
+    enum { MIN_HASHED = 8 };
+
+    // Marks a removed table slot
+    static char removed_mark;
+    static AssocRec<K,V> *removed()
+    {
+	return reinterpret_cast<AssocRec<K,V> *>(&removed_mark);
+    }
+
+    // Enter E into TABLE.  If there are other entries with the same
+    // key, E is placed in front of them, such that lookups find the
+    // most recently inserted entry, as in the list.
+    void enter(AssocRec<K,V> *e)
+    {
+	int mask = table_size - 1;
+	for (int i = int(e->hash & mask); ; i = (i + 1) & mask)
+	{
+	    AssocRec<K,V> *t = table[i];
+	    if (t == 0 || t == removed())
+	    {
+		if (t == 0)
+		    table_used++;
+		table[i] = e;
+		return;
+	    }
+
+	    if (t->hash == e->hash && t->key == e->key)
+	    {
+		// Take its place and move the older one along
+		table[i] = e;
+		e = t;
+	    }
+	}
+    }
+
+    // Remove E from TABLE
+    void leave(AssocRec<K,V> *e)
+    {
+	int mask = table_size - 1;
+	for (int i = int(e->hash & mask); table[i] != 0; i = (i + 1) & mask)
+	{
+	    if (table[i] == e)
+	    {
+		table[i] = removed();
+		return;
+	    }
+	}
+
+	assert(0);		// Not found
+    }
+
+    // Rebuild TABLE with SIZE slots
+    void build(int size)
     {
+	delete[] table;
+	table = new AssocRec<K,V> *[size];
+	table_size = size;
+	table_used = 0;
+	for (int i = 0; i < size; i++)
+	    table[i] = 0;
+
+	// Enter the entries in list order, such that the most recent
+	// of several entries with the same key comes first
+	int mask = table_size - 1;
 	for (AssocRec<K,V> *e = entries; e != 0; e = e->next)
-	    if (key == e->key)
+	{
+	    int j = int(e->hash & mask);
+	    while (table[j] != 0)
+		j = (j + 1) & mask;
+	    table[j] = e;
+	    table_used++;
+	}
+    }
+
+    // Return a table size suitable for N entries (load factor <= 3/4)
+    static int size_for(int n)
+    {
+	int size = 16;
+	while (size * 3 < (n + 1) * 4)
+	    size *= 2;
+	return size;
+    }
+
+    // Make sure there is room for one more entry
+    void grow()
+    {
+	if (table == 0)
+	{
+	    if (count >= MIN_HASHED)
+		build(size_for(count + 1));
+	}
+	else if ((table_used + 1) * 4 > table_size * 3)
+	{
+	    // Too full.  If this is because of removed slots, rebuilding
+	    // at the same size suffices.
+	    build(size_for(count + 1));
+	}
+    }
+
+protected:
+    virtual AssocRec<K,V> *lookup(const K& key) const
+    {
+	if (table == 0)
+	{
+	    for (AssocRec<K,V> *e = entries; e != 0; e = e->next)
+		if (key == e->key)
+		    return e;
+
+	    return 0;
+	}
+
+	unsigned long hash = assoc_hash(key);
+	int mask = table_size - 1;
+	for (int i = int(hash & mask); table[i] != 0; i = (i + 1) & mask)
+	{
+	    AssocRec<K,V> *e = table[i];
+	    if (e != removed() && e->hash == hash && key == e->key)
 		return e;
+	}
 
 	return 0;
     }
 
     virtual AssocRec<K,V> *insert(const K& key)
     {
+	grow();
+
 	AssocRec<K,V> *e = new AssocRec<K,V>(key);
 	e->next = entries;
-	return entries = e;
+	if (entries != 0)
+	    entries->prev = e;
+	entries = e;
+	count++;
+
+	if (table != 0)
+	    enter(e);
+
+	return e;
+    }
+
+    // Unlink and delete E
+    void unlink(AssocRec<K,V> *e)
+    {
+	if (table != 0)
+	    leave(e);
+
+	if (e->prev == 0)
+	    entries = e->next;
+	else
+	    e->prev->next = e->next;
+	if (e->next != 0)
+	    e->next->prev = e->prev;
+
+	count--;
+	delete e;
     }
 
 private:
@@ -99,12 +294,17 @@ private:
           delete e;
       }
       entries = 0;
+      count = 0;
+
+      delete[] table;
+      table = 0;
+      table_size = table_used = 0;
    }
 
 public:
     // Constructors
     _Assoc():
-	entries(0)
+	entries(0), table(0), table_size(0), table_used(0), count(0)
     {}
 
     // Destructor
@@ -114,6 +314,25 @@ public:
     }
 
     // Resources
+    int size() const { return count; }
+
+    // Make room for N entries without rehashing
+    void reserve(int n)
+    {
+	if (n < MIN_HASHED && table == 0)
+	    return;
+
+	int size = size_for(n);
+	if (size > table_size)
+	    build(size);
+    }
+
+    // Rebuild the hash table, dropping removed slots
+    void rehash()
+    {
+	if (table != 0)
+	    build(size_for(count));
+    }
 
     // Access (or create) element KEY
     V& operator[] (const K& key)
@@ -148,39 +367,21 @@ public:
     // Remove up to N elements KEY
     void remove(const K& key, int n = -1)
     {
-	if (n == 0)
-	    return;
-
-	AssocRec<K,V> *prev = 0;
-	AssocRec<K,V> *e = entries;
-	while (e != 0)
+	// LOOKUP returns the most recent element KEY, as a list
+	// traversal would
+	AssocRec<K,V> *e;
+	while (n != 0 && (e = lookup(key)) != 0)
 	{
-	    AssocRec<K,V> *next = e->next;
-
-	    if (key == e->key)
-	    {
-		if (prev == 0)
-		    entries = next;
-		else
-		    prev->next = next;
-		delete e;
-
-		if (--n == 0)
-		    return;
-	    }
-	    else
-	    {
-		prev = e;
-	    }
-
-	    e = next;
+	    unlink(e);
+	    n--;
 	}
     }
 
     // Copy constructor
     _Assoc(const _Assoc<K,V>& m):
-	entries(0)
+	entries(0), table(0), table_size(0), table_used(0), count(0)
     {
+	reserve(m.count);
 	for (AssocRec<K,V> *e = m.entries; e != 0; e = e->next)
 	    (*this)[e->key] = e->value;
     }
@@ -190,10 +391,9 @@ public:
     {
 	if (this != &m)
 	{
-	    if (entries)
-		destroyAll();
-	    entries = 0;
+	    destroyAll();
 
+	    reserve(m.count);
 	    for (AssocRec<K,V> *e = m.entries; e != 0; e = e->next)
 		(*this)[e->key] = e->value;
 	}
@@ -202,6 +402,8 @@ public:
     }
 };
 
+template<class K, class V>
+char _Assoc<K,V>::removed_mark = 0;
 
 template<class K, class V>
 class AssocMark {
@@ -298,17 +500,8 @@ public:
     // Truncate array up to assoc iterator
     void release (const AssocMark<K, V>& mark)
     {
-	AssocRec<K, V> *e = this->entries;
-
-	while (e != 0 && e != mark.rec)
-	{
-	    AssocRec<K, V> *tmp = e;
-	    e = e->next;
-	    tmp->next = 0;
-	    delete tmp;
-	}
-
-	this->entries = e;
+	while (this->entries != 0 && this->entries != mark.rec)
+	    this->unlink(this->entries);
     }
 
     // Constructor
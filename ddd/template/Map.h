@@ -28,7 +28,11 @@
 //-----------------------------------------------------------------------------
 // A Map Template
 // The Key should not be 0, since this value has special meaning for
-// first() and next().  Also, '==' must be defined for Key.
+// first() and next().  Also, '==' and assoc_hash() must be defined
+// for Key.
+//
+// A Map is an Assoc of pointers: keys are hashed for lookup, and
+// iteration runs through the list, most recently inserted key first.
 //-----------------------------------------------------------------------------
 
 //-----------------------------------------------------------------------------
@@ -37,69 +41,33 @@
 
 #include "base/bool.h"
 #include "base/assert.h"
+#include "template/Assoc.h"
 
 typedef void *MapRef;
 
 template <class Key, class Contents>
-class Map {
-    // Internal list node
-    struct MapNode {
-	Key key;
-	Contents *cont;
-	MapNode *_next;
-    };
-
-private:
-    MapNode *_first;
-    int _length;
-
-    // Search K; return 0 if not found
-    MapNode *search(Key k) const
-    {
-	MapNode *ln;
-	
-	ln = _first;
-	while (ln != 0 && !(ln->key == k)) 
-	    ln = ln->_next;
-	return ln;
-    }
+class Map: private Assoc<Key, Contents *> {
+    typedef AssocRec<Key, Contents *> MapNode;
 
 public:
     // Create empty map
     Map()
-	: _first(0), _length(0) 
+	: Assoc<Key, Contents *>()
     {}
 
     // Remove all elements
     void clear()
     {
-	MapNode *ln;
-	MapNode *prev;
-
-	ln = _first;
-	while (ln != 0) {
-	    prev = ln;
-	    ln = ln->_next;
-	    delete prev;
-	}
-	_first = 0;
-	_length = 0;
+	while (this->entries != 0)
+	    this->unlink(this->entries);
     }
 
     // Remove all elements, delete'ing each content
     void delete_all_contents()
     {
-	MapNode *ln   = _first;
-	MapNode *prev = 0;
-	while (ln != 0)
-	{
-	    prev = ln;
-	    ln = ln->_next;
-	    delete prev->cont;
-	    delete prev;
-	}
-	_first = 0;
-	_length = 0;
+	for (MapNode *ln = this->entries; ln != 0; ln = ln->next)
+	    delete ln->value;
+	clear();
     }
 
     
@@ -115,90 +83,54 @@ public:
 	if (c == 0) // Don't add empty stuff
 	    return 0;
 
-	MapNode *ln = search(k);
+	MapNode *ln = this->lookup(k);
 	if (ln == 0)
-	{
-	    // Insert
-	    ln = new MapNode;
-	    ln->key = k;
-	    ln->cont = c;
-
-	    ln->_next = _first;
-	    _first = ln;
-	    _length++;
-	}
-	else
-	{
-	    // Overwrite
-	    ln->cont = c;
-	}
+	    ln = Assoc<Key, Contents *>::insert(k);
+	ln->value = c;
 	return 1;
     }
     
     // Delete K if found
     void del(Key k)
     {
-	if (_first == 0)
-	    return;
-    
-	MapNode *prev = 0;
-	MapNode *ln = _first;
-    
-	while (ln != 0 && !(ln->key == k))
-	{
-	    prev = ln;
-	    ln = ln->_next;
-	}
-
+	MapNode *ln = this->lookup(k);
 	if (ln == 0)
 	    return; // not found
-		       
-	if (prev == 0)
-	{
-	    // delete first element
-	    assert(_first == ln);
-	    _first = _first->_next;
-	    delete ln;
-	    _length--;
-	}
-	else
-	{
-	    prev->_next = ln->_next;
-	    delete ln;
-	    _length--;
-	}
+
+	this->unlink(ln);
+
 	assert(!contains(k));
     }
 
     // Get contents of K; return 0 if not found
     Contents *get(Key k) const
     {
-	MapNode *ln = search(k);
+	MapNode *ln = this->lookup(k);
 	if (ln == 0)
 	    return 0;
 	else 
-	    return ln->cont;
+	    return ln->value;
     }
     
     // true if K is contained
     bool contains(Key k) const
     {
-	return search (k) != 0;
+	return this->lookup(k) != 0;
     }
     
     // Return first key, or 0 if not found.
     // This simulates a 0-terminated list.
     Key first_key(MapRef& ref) const
     {
-	if (_first == 0)
+	if (this->entries == 0)
 	{
 	    ref = 0;
 	    return 0;
 	}
 	else
 	{
-	    ref = _first->_next;
-	    return _first->key;
+	    ref = this->entries->next;
+	    return this->entries->key;
 	}
     }
 
@@ -212,7 +144,7 @@ public:
 	else
 	{
 	    MapNode *current_ln = (MapNode *) ref;
-	    ref = current_ln->_next;
+	    ref = current_ln->next;
 	    return current_ln->key;
 	}
     }
@@ -220,15 +152,15 @@ public:
     // Return first contents, or 0 if not found
     Contents *first(MapRef& ref) const
     {
-	if (_first == 0)
+	if (this->entries == 0)
 	{
 	    ref = 0;
 	    return 0;
 	}
 	else
 	{
-	    ref = _first->_next;
-	    return _first->cont;
+	    ref = this->entries->next;
+	    return this->entries->value;
 	}
     }
 
@@ -242,12 +174,12 @@ public:
 	else
 	{
 	    MapNode *current_ln = (MapNode *) ref;
-	    ref = current_ln->_next;
-	    return current_ln->cont;
+	    ref = current_ln->next;
+	    return current_ln->value;
 	}
     }
 
-    inline int length()  const { return _length; }
+    inline int length()  const { return this->size(); }
 
 private:
     // No copy constructor
@@ -29,6 +29,11 @@
 // Read variable values in string representation
 //-----------------------------------------------------------------------------
 
+// The readers consume what they read from VALUE.  If VALUE is
+// consuming (see `string::consuming()'), as in DispValue::init(),
+// this only advances its start; so VALUE serves as a cursor and
+// reading is linear in the size of VALUE.  `test-value' checks this.
+
 #ifndef _DDD_value_read_h
 #define _DDD_value_read_h
 